@@ -0,0 +1,12 @@
+#ifndef ARCHIVE_HPP
+#define ARCHIVE_HPP
+
+// Level packs: many compiled levels in one indexed file (layout in pack.hpp).
+//   mtdl --pack create -o <archive> <file | @listfile>... [-format json|bin] [-no-opt] [-j n]
+//   mtdl --pack ls <archive>
+//   mtdl --pack extract <archive> [<level>...] [--out-dir <dir>]
+// Every map in a source becomes its own level. argv[1] is "--pack". Returns the
+// process exit code.
+int runPack(int argc, char* argv[]);
+
+#endif // ARCHIVE_HPP
@@ -10,6 +10,37 @@ struct AstNode {
     virtual ~AstNode() {}
 };
 
+// Compile-time arithmetic expression written where a number is expected. The
+// parser folds every expression through ConstantEvaluator as soon as it is read,
+// so declaration nodes only ever hold the resulting literals.
+struct Expr {
+    enum class Kind { Literal, Constant, Negate, Add, Subtract, Multiply, Divide };
+
+    Kind kind;
+    std::string text;             // Literal as written, or the constant's name
+    bool isFloat = false;         // Literal has a decimal point
+    std::shared_ptr<Expr> left;   // Operand of Negate, left operand of the others
+    std::shared_ptr<Expr> right;
+    int line = 0;
+};
+
+// Top-level constant binding: const name = expression;
+struct ConstDecl : AstNode {
+    std::string name;     // Constant identifier
+    bool isFloat;         // Type of the folded value
+    double value;         // Folded value (exact for integers)
+};
+
+struct ModuleInterface;
+
+// Top-level import of a module's enemies, towers and constants: import "path";
+// The parser resolves it through a ModuleLoader, so module is set before the
+// declaration reaches semantic analysis (null when parsed without a loader).
+struct ImportDecl : AstNode {
+    std::string path;                               // As written
+    std::shared_ptr<const ModuleInterface> module;  // Loaded interface
+};
+
 // Map declaration node - defines game map properties
 struct MapDecl : AstNode {
     std::string name;                       // Map identifier
@@ -35,12 +66,18 @@ struct TowerDecl : AstNode {
     double fireRate;     // Attacks per second
 };
 
-// Individual spawn statement within a wave
+// Individual spawn statement within a wave. A repeat statement is a spawn issued
+// times times: iteration k spawns count + k*countStep enemies from start + k*every,
+// interval + k*intervalStep apart.
 struct SpawnStmt {
     std::string enemyType;  // Type of enemy to spawn
     int count;              // Number of enemies to spawn
     int start;              // Start time (seconds)
     int interval;           // Time between spawns (seconds)
+    int times = 1;          // Iterations of a repeat statement
+    int every = 0;          // Start offset between iterations (seconds)
+    int countStep = 0;      // Count added per iteration
+    int intervalStep = 0;   // Interval added per iteration
 };
 
 // Wave declaration node - defines enemy wave configuration
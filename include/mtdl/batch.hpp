@@ -0,0 +1,16 @@
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include <string>
+#include <vector>
+
+// Batch mode: compile many sources in one process on a work-stealing pool.
+//   mtdl --batch <file | @listfile>... --out-dir <dir> [-format f] [-normalized] [-no-opt] [-j n]
+// argv[1] is "--batch". Returns the process exit code (non-zero if any file failed).
+int runBatch(int argc, char* argv[]);
+
+// Append one command-line input to inputs, expanding @listfile arguments (one path
+// per line, '#' starts a comment). Reports and returns false if a list is unreadable.
+bool collectInputs(const std::string& arg, std::vector<std::string>& inputs);
+
+#endif // BATCH_HPP
@@ -0,0 +1,249 @@
+#ifndef BINARY_HPP
+#define BINARY_HPP
+
+// Header-only reader for the MTDL binary game configuration (-format bin).
+//
+// The file is a flat little-endian image: a fixed header, a table of sections
+// and one array of fixed-size records per section, followed by a string blob.
+// Every record is 8-byte aligned, so a buffer obtained from mmap (or any other
+// 8-byte aligned allocation) can be read in place without parsing or copying.
+//
+// This header has no dependencies beyond the standard library and can be
+// dropped into a game client as-is.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+constexpr char BIN_MAGIC[4] = {'M', 'T', 'D', 'B'};
+constexpr uint16_t BIN_VERSION = 2;
+constexpr uint32_t BIN_ENDIAN_TAG = 0x01020304;
+constexpr uint32_t BIN_NO_INDEX = 0xFFFFFFFF;  // Unresolved entity reference
+
+// Section identifiers, in file order
+enum BinSection : uint32_t {
+    BIN_SECTION_MAP,
+    BIN_SECTION_PATH,
+    BIN_SECTION_ENEMIES,
+    BIN_SECTION_TOWERS,
+    BIN_SECTION_WAVES,
+    BIN_SECTION_SPAWNS,
+    BIN_SECTION_REPEATS,
+    BIN_SECTION_PLACEMENTS,
+    BIN_SECTION_STRINGS,
+    BIN_SECTION_COUNT
+};
+
+// Location of one section: byte offset from the start of the file and element count
+// (byte count for the string blob)
+struct BinSectionEntry {
+    uint32_t offset;
+    uint32_t count;
+};
+
+struct BinHeader {
+    char magic[4];                                // "MTDB"
+    uint16_t version;                             // BIN_VERSION
+    uint16_t headerSize;                          // sizeof(BinHeader)
+    uint32_t endianTag;                           // BIN_ENDIAN_TAG as written by the compiler
+    uint32_t fileSize;                            // Total size in bytes
+    BinSectionEntry sections[BIN_SECTION_COUNT];  // Indexed by BinSection
+};
+
+// Strings are byte offsets into the string blob; each entry is NUL-terminated and
+// preceded by its uint32_t length
+typedef uint32_t BinString;
+
+struct BinMap {
+    BinString name;
+    int32_t width;
+    int32_t height;
+    uint32_t pathLength;  // Points in BIN_SECTION_PATH belonging to this map
+};
+
+struct BinPoint {
+    int32_t x;
+    int32_t y;
+};
+
+enum BinEnemyFlags : uint32_t {
+    BIN_ENEMY_HAS_HP = 1u << 0,
+    BIN_ENEMY_HAS_SPEED = 1u << 1,
+    BIN_ENEMY_HAS_REWARD = 1u << 2
+};
+
+struct BinEnemy {
+    BinString name;
+    uint32_t flags;  // BinEnemyFlags
+    double speed;
+    int32_t hp;
+    int32_t reward;
+};
+
+enum BinTowerFlags : uint32_t {
+    BIN_TOWER_HAS_RANGE = 1u << 0,
+    BIN_TOWER_HAS_DAMAGE = 1u << 1,
+    BIN_TOWER_HAS_FIRE_RATE = 1u << 2,
+    BIN_TOWER_HAS_COST = 1u << 3,
+    BIN_TOWER_HAS_DPS = 1u << 4   // Only present in optimized output
+};
+
+struct BinTower {
+    BinString name;
+    uint32_t flags;  // BinTowerFlags
+    double fireRate;
+    double dps;
+    int32_t range;
+    int32_t damage;
+    int32_t cost;
+    uint32_t reserved;
+};
+
+struct BinWave {
+    BinString name;
+    uint32_t firstSpawn;  // Index into BIN_SECTION_SPAWNS
+    uint32_t spawnCount;
+    uint32_t reserved;
+};
+
+enum BinSpawnFlags : uint32_t {
+    BIN_SPAWN_HAS_COUNT = 1u << 0,
+    BIN_SPAWN_HAS_START = 1u << 1,
+    BIN_SPAWN_HAS_INTERVAL = 1u << 2,
+    BIN_SPAWN_HAS_TOTAL_DURATION = 1u << 3
+};
+
+// A repeated spawn stores its first iteration; totalDuration then runs from its
+// start to the end of the latest iteration. See BinaryConfigView::iteration.
+struct BinSpawn {
+    uint32_t enemy;       // Index into BIN_SECTION_ENEMIES, or BIN_NO_INDEX
+    BinString enemyName;  // Kept for references that do not resolve (e.g. after DCE)
+    uint32_t flags;       // BinSpawnFlags
+    int32_t count;
+    int32_t start;
+    int32_t interval;
+    int32_t totalDuration;
+    uint32_t repeat;      // Index into BIN_SECTION_REPEATS, or BIN_NO_INDEX
+};
+
+// Iteration k (0 <= k < times) of a repeated spawn spawns count + k*countStep
+// enemies from start + k*every, interval + k*intervalStep apart
+struct BinRepeat {
+    int32_t times;
+    int32_t every;
+    int32_t countStep;
+    int32_t intervalStep;
+};
+
+struct BinPlacement {
+    uint32_t tower;       // Index into BIN_SECTION_TOWERS, or BIN_NO_INDEX
+    BinString towerName;
+    int32_t x;
+    int32_t y;
+};
+
+static_assert(sizeof(BinHeader) % 8 == 0, "BinHeader must keep records 8-byte aligned");
+static_assert(sizeof(BinMap) == 16 && sizeof(BinPoint) == 8, "unexpected record padding");
+static_assert(sizeof(BinEnemy) == 24 && sizeof(BinTower) == 40, "unexpected record padding");
+static_assert(sizeof(BinWave) == 16 && sizeof(BinSpawn) == 32, "unexpected record padding");
+static_assert(sizeof(BinRepeat) == 16, "unexpected record padding");
+static_assert(sizeof(BinPlacement) == 16, "unexpected record padding");
+
+// Read-only view over a binary configuration held in memory. Does not own the buffer.
+class BinaryConfigView {
+public:
+    BinaryConfigView(const void* data, size_t size)
+        : base(static_cast<const unsigned char*>(data)), size(size) {}
+
+    // Check magic, version, byte order and that every section lies inside the buffer
+    bool valid() const {
+        if (size < sizeof(BinHeader) || reinterpret_cast<uintptr_t>(base) % 8 != 0) return false;
+        const BinHeader& h = header();
+        if (std::memcmp(h.magic, BIN_MAGIC, 4) != 0 || h.version != BIN_VERSION ||
+            h.headerSize != sizeof(BinHeader) || h.endianTag != BIN_ENDIAN_TAG ||
+            h.fileSize > size) {
+            return false;
+        }
+        static const size_t recordSizes[BIN_SECTION_COUNT] = {
+            sizeof(BinMap), sizeof(BinPoint), sizeof(BinEnemy), sizeof(BinTower),
+            sizeof(BinWave), sizeof(BinSpawn), sizeof(BinRepeat), sizeof(BinPlacement), 1
+        };
+        for (uint32_t s = 0; s < BIN_SECTION_COUNT; s++) {
+            const BinSectionEntry& e = h.sections[s];
+            if (e.offset % 8 != 0 || e.offset > h.fileSize ||
+                static_cast<uint64_t>(e.count) * recordSizes[s] > h.fileSize - e.offset) {
+                return false;
+            }
+        }
+        return mapCount() <= 1;
+    }
+
+    const BinHeader& header() const { return *reinterpret_cast<const BinHeader*>(base); }
+
+    uint32_t mapCount() const { return header().sections[BIN_SECTION_MAP].count; }
+    uint32_t enemyCount() const { return header().sections[BIN_SECTION_ENEMIES].count; }
+    uint32_t towerCount() const { return header().sections[BIN_SECTION_TOWERS].count; }
+    uint32_t waveCount() const { return header().sections[BIN_SECTION_WAVES].count; }
+    uint32_t spawnCount() const { return header().sections[BIN_SECTION_SPAWNS].count; }
+    uint32_t repeatCount() const { return header().sections[BIN_SECTION_REPEATS].count; }
+    uint32_t placementCount() const { return header().sections[BIN_SECTION_PLACEMENTS].count; }
+    uint32_t pathLength() const { return header().sections[BIN_SECTION_PATH].count; }
+
+    const BinMap* map() const { return mapCount() ? records<BinMap>(BIN_SECTION_MAP) : nullptr; }
+    const BinPoint& pathPoint(uint32_t i) const { return records<BinPoint>(BIN_SECTION_PATH)[i]; }
+    const BinEnemy& enemy(uint32_t i) const { return records<BinEnemy>(BIN_SECTION_ENEMIES)[i]; }
+    const BinTower& tower(uint32_t i) const { return records<BinTower>(BIN_SECTION_TOWERS)[i]; }
+    const BinWave& wave(uint32_t i) const { return records<BinWave>(BIN_SECTION_WAVES)[i]; }
+    const BinSpawn& spawn(uint32_t i) const { return records<BinSpawn>(BIN_SECTION_SPAWNS)[i]; }
+
+    // Series of a repeated spawn; nullptr for a single spawn or an out-of-range index
+    const BinRepeat* repeat(const BinSpawn& spawn) const {
+        if (spawn.repeat >= repeatCount()) return nullptr;
+        return &records<BinRepeat>(BIN_SECTION_REPEATS)[spawn.repeat];
+    }
+
+    // Number of spawns a spawn record stands for
+    uint32_t iterations(const BinSpawn& spawn) const {
+        const BinRepeat* series = repeat(spawn);
+        return series ? static_cast<uint32_t>(series->times) : 1;
+    }
+
+    // Iteration k of a spawn record as a single spawn
+    BinSpawn iteration(const BinSpawn& spawn, uint32_t k) const {
+        BinSpawn single = spawn;
+        single.repeat = BIN_NO_INDEX;
+        if (const BinRepeat* series = repeat(spawn)) {
+            single.count = spawn.count + static_cast<int32_t>(k) * series->countStep;
+            single.start = spawn.start + static_cast<int32_t>(k) * series->every;
+            single.interval = spawn.interval + static_cast<int32_t>(k) * series->intervalStep;
+            if (spawn.flags & BIN_SPAWN_HAS_TOTAL_DURATION) single.totalDuration = single.count * single.interval;
+        }
+        return single;
+    }
+    const BinPlacement& placement(uint32_t i) const {
+        return records<BinPlacement>(BIN_SECTION_PLACEMENTS)[i];
+    }
+
+    // Resolve a string reference; returns an empty view for out-of-range offsets
+    std::string_view string(BinString offset) const {
+        const BinSectionEntry& e = header().sections[BIN_SECTION_STRINGS];
+        if (static_cast<uint64_t>(offset) + sizeof(uint32_t) > e.count) return std::string_view();
+        uint32_t length;
+        std::memcpy(&length, base + e.offset + offset, sizeof(length));
+        if (length > e.count - offset - sizeof(uint32_t)) return std::string_view();
+        return std::string_view(reinterpret_cast<const char*>(base + e.offset + offset + sizeof(uint32_t)),
+                                length);
+    }
+
+private:
+    const unsigned char* base;
+    size_t size;
+
+    template <typename T>
+    const T* records(BinSection section) const {
+        return reinterpret_cast<const T*>(base + header().sections[section].offset);
+    }
+};
+
+#endif // BINARY_HPP
@@ -0,0 +1,66 @@
+#ifndef CACHE_HPP
+#define CACHE_HPP
+
+#include "driver.hpp"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+// Counters for one process's use of the cache
+struct CacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t stores = 0;
+    uint64_t evictions = 0;
+};
+
+// Content-addressed on-disk cache of compiled artifacts.
+//
+// Entries are keyed by a hash of the source bytes, the sources of the modules it
+// imports, the compiler version, the compile options and the optimizer pipeline,
+// so a hit needs no lexing at all (imports are found by the boundary pre-scan).
+// Entries are written to a temporary file and renamed into place, which keeps the
+// directory safe to share between concurrent processes. When the directory grows
+// past its size cap, the least recently used entries (by modification time, which
+// is refreshed on every hit) are evicted. Temporary files count toward the cap,
+// and eviction removes those a crashed writer left behind.
+class CompilationCache {
+public:
+    CompilationCache(const std::string& directory, uint64_t maxBytes);
+
+    // Cache key for compiling source with the given options
+    static std::string makeKey(const std::string& source, const CompileOptions& options);
+
+    // Fetch an artifact; returns false on a miss or a corrupt entry
+    bool lookup(const std::string& key, std::string& artifact);
+
+    // Atomically publish an artifact, evicting old entries if over the size cap
+    void store(const std::string& key, const std::string& artifact);
+
+    CacheStats stats() const;
+
+    // One-line summary of hits, misses and on-disk size
+    std::string statsReport() const;
+
+private:
+    std::string directory;
+    uint64_t maxBytes;
+
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> stores{0};
+    std::atomic<uint64_t> evictions{0};
+
+    std::mutex sizeMutex;
+    uint64_t approximateBytes = 0;  // Updated locally; other processes may also add entries
+
+    std::string entryPath(const std::string& key) const;
+    uint64_t scanSize() const;
+    void evict();
+};
+
+// Parse a -cache-max value: a whole number of MiB whose byte count fits in 64 bits
+bool parseCacheMaxMiB(const std::string& text, uint64_t& mib);
+
+#endif // CACHE_HPP
@@ -2,8 +2,24 @@
 #define CODEGEN_HPP
 
 #include "ir.hpp"
+#include <cstdio>
+#include <ostream>
 #include <string>
 #include <vector>
+#include <unordered_map>
+
+// Instruction indices grouped by output section, built in a single pass over the IR.
+// Spawns are stored in CSR form: the spawns of waves[w] are
+// spawns[spawnOffsets[w]] .. spawns[spawnOffsets[w + 1] - 1], in IR order.
+struct SectionIndex {
+    const IrInstruction* map = nullptr;   // First DEFINE_MAP, if any
+    std::vector<size_t> enemies;          // DEFINE_ENEMY indices
+    std::vector<size_t> towers;           // DEFINE_TOWER indices
+    std::vector<size_t> waves;            // DEFINE_WAVE indices
+    std::vector<size_t> spawnOffsets;     // waves.size() + 1 offsets into spawns
+    std::vector<size_t> spawns;           // SPAWN_ENEMY/REPEAT_SPAWN indices grouped by wave
+    std::vector<size_t> placements;       // PLACE_TOWER indices
+};
 
 // Generates final output from optimized IR
 class CodeGenerator {
@@ -11,17 +27,113 @@ public:
     // Generate JSON configuration from IR
     std::string generateJSON(const std::vector<IrInstruction>& instructions);
 
+    // In normalized JSON, names live in a single "strings" table and every name is
+    // emitted as an index into it; spawns and placements reference enemies and
+    // towers by their index in the "enemies"/"towers" arrays. Enemies and towers
+    // are sorted by name and placements by tower and position, so indices do not
+    // depend on declaration order; waves keep theirs, which is the play order.
+    void setNormalized(bool enabled) { normalized = enabled; }
+
     // Generate human-readable text output from IR
     std::string generateReadable(const std::vector<IrInstruction>& instructions);
 
+    // Generate flat binary configuration (layout and reader in binary.hpp)
+    std::string generateBinary(const std::vector<IrInstruction>& instructions);
+
+    // Generate a C++17 header of constexpr tables for levels compiled into the game
+    std::string generateCppHeader(const std::vector<IrInstruction>& instructions);
+
+    // Rebuild IR from a binary configuration; throws std::runtime_error if malformed
+    static std::vector<IrInstruction> decodeBinary(const std::string& bytes);
+
+    // Group instructions by section; independent of the order of the IR stream
+    static SectionIndex buildSectionIndex(const std::vector<IrInstruction>& instructions);
+
 private:
+    friend class JsonStreamWriter;
+    friend class SharedJsonRenderer;
+
+    bool normalized = false;
+    std::vector<std::string> strings;                     // Normalized string table
+    std::unordered_map<std::string, size_t> stringIds;    // Name -> index in strings
+    std::unordered_map<std::string, size_t> enemyIds;     // Enemy name -> index in enemies
+    std::unordered_map<std::string, size_t> towerIds;     // Tower name -> index in towers
+
     // JSON helper functions
     std::string escapeJSON(const std::string& str);
+    std::string nameJSON(const std::string& name);
+    std::string referenceJSON(const std::string& key, const std::string& name,
+                              const std::unordered_map<std::string, size_t>& ids);
+    void sortCanonically(const std::vector<IrInstruction>& instructions, SectionIndex& sections);
+    void buildNormalizedTables(const std::vector<IrInstruction>& instructions,
+                               const SectionIndex& sections);
     std::string generateMapJSON(const IrInstruction& instruction);
     std::string generateEnemyJSON(const IrInstruction& instruction);
     std::string generateTowerJSON(const IrInstruction& instruction);
-    std::string generateWaveJSON(const std::vector<IrInstruction>& instructions, size_t& index);
+    // Written straight to json, since expanding REPEAT_SPAWN series can make one wave large
+    void generateWaveJSON(std::ostream& json, const std::vector<IrInstruction>& instructions,
+                          const SectionIndex& sections, size_t wave);
+    void generateSpawnJSON(std::ostream& json, const IrInstruction& spawn);
     std::string generatePlacementJSON(const IrInstruction& instruction);
 };
 
+// Streaming counterpart of generateJSON for IR produced one declaration at a time.
+// Entities are rendered as they arrive and spilled to one temporary file per
+// section, so memory does not grow with the input; finish() writes the document
+// generateJSON would produce for all appended IR. Not available for normalized
+// output, whose string table has to come first.
+class JsonStreamWriter {
+public:
+    JsonStreamWriter();
+    ~JsonStreamWriter();
+
+    JsonStreamWriter(const JsonStreamWriter&) = delete;
+    JsonStreamWriter& operator=(const JsonStreamWriter&) = delete;
+
+    // Render the IR of one declaration (a wave together with its spawns)
+    void append(const std::vector<IrInstruction>& declaration);
+
+    // Write the complete document; returns false if a spill file failed
+    bool finish(std::ostream& out);
+
+private:
+    enum Section { ENEMIES, TOWERS, WAVES, PLACEMENTS, SECTION_COUNT };
+
+    CodeGenerator generator;
+    bool hasMap = false;
+    std::string map;  // The first map, as in generateJSON
+    std::FILE* spills[SECTION_COUNT] = {};
+    size_t counts[SECTION_COUNT] = {};
+    bool failed = false;
+
+    bool separate(Section section);  // Separator before the next entity of section
+    void write(Section section, const std::string& fragment);
+};
+
+// JSON for IR that mostly shares its instructions with a base level (--sweep).
+// The entities of base are rendered once up front; render() reuses the fragment of
+// every entity made of the same instructions as in base, renders only the others
+// and returns exactly what generateJSON would. Not available for normalized output,
+// where an entity's text depends on the whole level. render() only reads the
+// renderer, so variants may be rendered concurrently.
+class SharedJsonRenderer {
+public:
+    explicit SharedJsonRenderer(const SharedIr& base);
+
+    std::string render(const SharedIr& ir) const;
+
+private:
+    struct WaveFragment {
+        std::vector<const IrInstruction*> spawns;  // The spawns it was rendered with
+        std::string json;
+    };
+
+    SharedIr base;  // Owns the cached instructions, so their addresses stay unique
+    std::unordered_map<const IrInstruction*, std::string> fragments;  // Map, enemies, towers, placements
+    std::unordered_map<const IrInstruction*, WaveFragment> waveFragments;
+
+    static std::string renderEntity(const IrInstruction& instruction);
+    static std::string renderWave(const IrInstruction& wave, const std::vector<const IrInstruction*>& spawns);
+};
+
 #endif // CODEGEN_H
@@ -0,0 +1,39 @@
+#ifndef CONSTANTS_HPP
+#define CONSTANTS_HPP
+
+#include "ast.hpp"
+#include <map>
+#include <string>
+
+// Result of folding an expression: an int or a double
+struct ConstantValue {
+    bool isFloat = false;
+    int integer = 0;
+    double real = 0.0;
+
+    double asDouble() const { return isFloat ? real : integer; }
+};
+
+// Folds expressions to constants at compile time and holds the const bindings
+// seen so far. Integer arithmetic is 32-bit like the attributes it feeds and
+// reports overflow; division truncates toward zero. An int combined with a float
+// gives a float, which must stay finite. Dividing by zero, reading an undefined
+// constant or binding a name twice is an error. Errors are std::runtime_error
+// messages ending in "at line N", like the parser's.
+class ConstantEvaluator {
+public:
+    ConstantValue evaluate(const Expr& expr) const;
+
+    void bind(const std::string& name, const ConstantValue& value, int line);
+
+    bool empty() const { return bindings.empty(); }
+
+    // Every binding as text; fragment parsers add it to their cache keys, because
+    // the same declaration text folds differently under different constants
+    std::string digest() const;
+
+private:
+    std::map<std::string, ConstantValue> bindings;
+};
+
+#endif // CONSTANTS_HPP
@@ -0,0 +1,46 @@
+#ifndef COVERAGE_HPP
+#define COVERAGE_HPP
+
+#include "geometry.hpp"
+#include "ir.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Static targeting data for the client (-format coverage). Paths do not move, so
+// for every PLACE_TOWER the stretches of the level's path (its first map's) within
+// the tower's range are known at compile time; an enemy is in range exactly when
+// its path progress lies in one of them. The inverted index lists, per path
+// segment, the placements covering part of it, so a lookup only tests those.
+struct CoverageTable {
+    struct Placement {
+        std::string tower;
+        int x = 0;
+        int y = 0;
+    };
+
+    std::string map;  // Empty when the level has no map
+    double pathLength = 0.0;
+    std::vector<double> segmentStarts;  // Arc length at the start of each segment
+
+    // Every placement in IR order, so indices match initialPlacements in the JSON
+    // output. Placement p covers intervals[intervalStart[p] .. intervalStart[p + 1]),
+    // sorted and disjoint.
+    std::vector<Placement> placements;
+    std::vector<size_t> intervalStart;
+    std::vector<PathInterval> intervals;
+
+    // Segment s is covered by segmentPlacements[segmentStart[s] .. segmentStart[s + 1]),
+    // ascending
+    std::vector<size_t> segmentStart;
+    std::vector<uint32_t> segmentPlacements;
+};
+
+CoverageTable buildCoverageTable(const std::vector<IrInstruction>& ir);
+
+// JSON form: intervals are written with two decimals, rounded outward so that a
+// lookup never misses an enemy in range
+std::string generateCoverageJSON(const CoverageTable& table);
+
+#endif // COVERAGE_HPP
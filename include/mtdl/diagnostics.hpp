@@ -0,0 +1,38 @@
+#ifndef DIAGNOSTICS_HPP
+#define DIAGNOSTICS_HPP
+
+#include <atomic>
+#include <string>
+
+// How much the compiler reports besides errors
+enum class Verbosity {
+    Silent,   // Errors only (default)
+    Normal,   // Phase progress and summaries (-v)
+    Verbose   // Also one remark per optimizer change (-vv)
+};
+
+// Process-wide sink for progress messages, remarks and errors. Messages are
+// appended to a buffer and written in batches, so a chatty compile costs a few
+// large writes instead of one synchronized stream write per line. Errors flush
+// everything buffered before them. Text messages go to stdout (errors to
+// stderr); with NDJSON every message is one JSON object per line on stderr.
+class Diagnostics {
+public:
+    static void configure(Verbosity level, bool ndjson);
+
+    static bool enabled(Verbosity level) { return level <= verbosity.load(std::memory_order_relaxed); }
+
+    // phase names the compiler stage ("parse", "optimize", ...) for NDJSON records;
+    // text output prints message as-is
+    static void info(const char* phase, const std::string& message);    // Verbosity::Normal
+    static void remark(const char* phase, const std::string& message);  // Verbosity::Verbose
+    static void error(const char* phase, const std::string& message);   // Always shown
+
+    // Write out everything buffered; call before printing to stdout directly
+    static void flush();
+
+private:
+    static std::atomic<Verbosity> verbosity;
+};
+
+#endif // DIAGNOSTICS_HPP
@@ -0,0 +1,51 @@
+#ifndef DRIVER_HPP
+#define DRIVER_HPP
+
+#include "ir.hpp"
+#include <string>
+#include <vector>
+
+// Compiler version; part of every cache key, so bump it whenever output changes
+constexpr const char* COMPILER_VERSION = "1.3.1";
+
+// Options for an in-memory compilation
+struct CompileOptions {
+    bool optimize = true;         // Run the optimizer
+    bool normalized = false;      // Index-normalized JSON
+    std::string format = "json";  // Artifact kind, see isArtifactKind
+    std::string importDirectory;  // Base of relative import paths (empty: working directory)
+};
+
+// Outcome of an in-memory compilation
+struct CompileResult {
+    bool success = false;
+    std::string output;  // Rendered artifact (empty on failure)
+    std::string error;   // Phase-prefixed diagnostic (empty on success)
+};
+
+// Artifact kinds accepted by -format and --emit: json, readable, ir-text, bin, cpp, coverage
+bool isArtifactKind(const std::string& kind);
+
+// Conventional file extension (including the dot) for an artifact kind
+std::string artifactExtension(const std::string& kind);
+
+// Render one artifact from optimized IR. Uses its own generators, so independent
+// artifacts can be rendered concurrently from the same (read-only) IR.
+std::string renderArtifact(const std::string& kind, const std::vector<IrInstruction>& ir, bool normalized);
+
+// Run the full pipeline on source text. Reentrant: keeps no global state and
+// reports errors through the result instead of writing to stdout/stderr.
+CompileResult compileSource(const std::string& source, const CompileOptions& options);
+
+// Run everything after parsing (semantic analysis through code generation) on an
+// already-parsed program. The program is only read, so its nodes may be shared.
+CompileResult compileProgram(std::shared_ptr<Program> program, const CompileOptions& options);
+
+// The part of compileSource/compileProgram before rendering: leaves the (optimized)
+// IR in ir, or returns false with a phase-prefixed message in error
+bool lowerSource(const std::string& source, bool optimize, std::vector<IrInstruction>& ir, std::string& error,
+                 const std::string& importDirectory = "");
+bool lowerProgram(std::shared_ptr<Program> program, bool optimize, std::vector<IrInstruction>& ir,
+                  std::string& error);
+
+#endif // DRIVER_HPP
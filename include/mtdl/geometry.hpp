@@ -0,0 +1,51 @@
+#ifndef GEOMETRY_HPP
+#define GEOMETRY_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Stretch of a path between two arc lengths from its start
+struct PathInterval {
+    double from;
+    double to;
+};
+
+// The polyline enemies walk on a map, as DEFINE_MAP's "path" metadata describes it.
+// Segments are kept as parallel arrays (start, unit direction, length, arc length
+// at the start) so range queries run as one branch-free loop over all segments.
+class MapPath {
+public:
+    MapPath() = default;
+
+    // points is "x,y;x,y;..."
+    explicit MapPath(const std::string& points);
+
+    bool empty() const { return pointX.empty(); }
+    double length() const { return totalLength; }
+
+    // Arc length at the start of each segment; a one-point path has none
+    const std::vector<double>& segmentStarts() const { return segmentOffset; }
+
+    // Distance from (x, y) to the nearest point of the path
+    double distanceTo(double x, double y) const;
+
+    // Length of the path within range of (x, y)
+    double lengthWithin(double x, double y, double range) const;
+
+    // Append the parts of the path within range of (x, y), in path order and with
+    // pieces that meet at a segment boundary joined, and the segments they touch
+    void intervalsWithin(double x, double y, double range, std::vector<PathInterval>& intervals,
+                         std::vector<uint32_t>& segments) const;
+
+private:
+    std::vector<double> pointX, pointY;
+    std::vector<double> directionX, directionY, segmentLength, segmentOffset;
+    double totalLength = 0.0;
+
+    // Where each segment enters and leaves the circle, as distances along it;
+    // enter == leave when it misses
+    void clipSegments(double x, double y, double range, double* enter, double* leave) const;
+};
+
+#endif // GEOMETRY_HPP
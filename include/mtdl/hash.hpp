@@ -0,0 +1,61 @@
+#ifndef HASH_HPP
+#define HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Streaming 64-bit FNV-1a hash used for content addressing
+class ContentHash {
+public:
+    ContentHash& update(const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            state ^= bytes[i];
+            state *= 0x100000001b3ULL;
+        }
+        return *this;
+    }
+
+    // The low `width` bytes of value, least significant first, so the hash does
+    // not depend on the host's byte order or integer sizes
+    ContentHash& updateLittleEndian(uint64_t value, size_t width) {
+        for (size_t i = 0; i < width; i++) {
+            unsigned char byte = static_cast<unsigned char>(value >> (8 * i));
+            update(&byte, 1);
+        }
+        return *this;
+    }
+
+    // Strings are length-prefixed so that ("ab", "c") and ("a", "bc") differ
+    ContentHash& update(const std::string& str) {
+        updateLittleEndian(str.size(), sizeof(uint64_t));
+        return update(str.data(), str.size());
+    }
+
+    uint64_t value() const { return state; }
+
+    // Fixed-width lowercase hex, suitable for file names
+    std::string hex() const {
+        static const char digits[] = "0123456789abcdef";
+        std::string out(16, '0');
+        for (int i = 15; i >= 0; i--) {
+            out[i] = digits[(state >> ((15 - i) * 4)) & 0xF];
+        }
+        return out;
+    }
+
+private:
+    uint64_t state = 0xcbf29ce484222325ULL;
+};
+
+// splitmix64 finalizer: turns neighbouring seeds (seed + 1, seed + 2, ...) into
+// unrelated ones for the seeded searches
+inline uint64_t mixSeed(uint64_t value) {
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+#endif // HASH_HPP
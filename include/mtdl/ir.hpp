@@ -18,7 +18,8 @@ enum class IrOpcode {
     PLACE_TOWER,     // Place a tower on the map
     SET_VALUE,       // Set a runtime value
     LOAD_CONST,      // Load a constant value
-    NOP              // No operation (for optimization)
+    NOP,             // No operation (for optimization)
+    REPEAT_SPAWN     // Spawn a series of enemy groups in a wave (see SpawnSeries)
 };
 
 // Single IR instruction with opcode, operands, and metadata
@@ -31,20 +32,75 @@ struct IrInstruction {
     IrInstruction(IrOpcode op) : opcode(op) {}
 };
 
+// The spawns of one REPEAT_SPAWN instruction (operands wave, enemy): iteration k,
+// 0 <= k < times, spawns count + k*countStep enemies from start + k*every,
+// interval + k*intervalStep apart. A SPAWN_ENEMY reads as a series of one.
+// Series are analysed in closed form and only expanded when output is written.
+struct SpawnSeries {
+    long long count = 0;
+    long long start = 0;
+    long long interval = 0;
+    long long times = 1;
+    long long every = 0;
+    long long countStep = 0;
+    long long intervalStep = 0;
+
+    SpawnSeries() = default;
+    explicit SpawnSeries(const IrInstruction& instruction);
+
+    long long countAt(long long k) const { return count + k * countStep; }
+    long long startAt(long long k) const { return start + k * every; }
+    long long intervalAt(long long k) const { return interval + k * intervalStep; }
+
+    // Latest startAt(k) + countAt(k) * intervalAt(k) over all iterations
+    long long end() const;
+
+    // Iterations first, first + step, ..., first + (length - 1) * step as a series
+    // of their own
+    SpawnSeries slice(long long first, long long length, long long step = 1) const;
+
+    // Instruction for this series with source's operands: REPEAT_SPAWN, or SPAWN_ENEMY
+    // for a single iteration. total_duration is filled in if source has it.
+    IrInstruction instruction(const IrInstruction& source) const;
+
+    // Iteration k of source's series as a SPAWN_ENEMY
+    IrInstruction iteration(const IrInstruction& source, long long k) const;
+};
+
+// IR whose unchanged instructions are shared between copies, e.g. a base level and
+// its --sweep variants
+using SharedIr = std::vector<std::shared_ptr<const IrInstruction>>;
+
 // Generates IR from AST
 class IrGenerator {
 public:
     // Generate intermediate code from AST
     std::vector<IrInstruction> generate(std::shared_ptr<Program> program);
 
+    // Generate intermediate code for a single top-level declaration
+    std::vector<IrInstruction> generateDeclaration(const AstNode* declaration);
+
     // Convert IR instructions to human-readable format
     std::vector<std::string> toString(const std::vector<IrInstruction>& instructions);
 
+    // Make generate() lower only the imported definitions that the program's spawns
+    // and placements reference, which are all dead code elimination would keep.
+    // Spares optimizing compiles the unused bulk of a shared catalog.
+    void setImportPruning(bool enabled) { pruneImports = enabled; }
+
+    // Imported definitions generate() has left out so far
+    size_t prunedImports() const { return pruned; }
+
 private:
     std::vector<IrInstruction> code;  // Generated IR code
+    bool pruneImports = false;
+    size_t pruned = 0;
 
     // Add an instruction to the IR stream
     void emit(const IrInstruction& instruction) { code.push_back(instruction); }
+
+    // Append the instructions for one declaration to code
+    void lowerDeclaration(const AstNode* declaration);
 };
 
 #endif // IR_H
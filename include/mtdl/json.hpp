@@ -0,0 +1,75 @@
+#ifndef JSON_HPP
+#define JSON_HPP
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Minimal JSON document model for tooling that has to read JSON (LSP messages,
+// previously emitted artifacts). Objects keep their members in insertion order.
+class JsonValue {
+public:
+    enum class Type { Null, Bool, Number, String, Array, Object };
+
+    JsonValue() : type(Type::Null) {}
+    JsonValue(bool value) : type(Type::Bool), boolean(value) {}
+    JsonValue(int value) : type(Type::Number), number(value) {}
+    JsonValue(long long value) : type(Type::Number), number(static_cast<double>(value)) {}
+    JsonValue(size_t value) : type(Type::Number), number(static_cast<double>(value)) {}
+    JsonValue(double value) : type(Type::Number), number(value) {}
+    JsonValue(const char* value) : type(Type::String), text(value) {}
+    JsonValue(const std::string& value) : type(Type::String), text(value) {}
+
+    static JsonValue array() { JsonValue v; v.type = Type::Array; return v; }
+    static JsonValue object() { JsonValue v; v.type = Type::Object; return v; }
+
+    // Parse a complete JSON text; throws std::runtime_error on malformed input
+    static JsonValue parse(const std::string& input);
+
+    // Compact serialization
+    std::string serialize() const;
+
+    Type kind() const { return type; }
+    bool isNull() const { return type == Type::Null; }
+    bool isNumber() const { return type == Type::Number; }
+    bool isString() const { return type == Type::String; }
+    bool isArray() const { return type == Type::Array; }
+    bool isObject() const { return type == Type::Object; }
+
+    bool asBool() const { return type == Type::Bool && boolean; }
+    double asNumber() const { return type == Type::Number ? number : 0.0; }
+    long long asInt() const { return static_cast<long long>(asNumber()); }
+    const std::string& asString() const { return text; }
+
+    // Member or element access; missing entries read as null
+    const JsonValue& operator[](const std::string& key) const;
+    const JsonValue& operator[](size_t index) const;
+    bool has(const std::string& key) const;
+    size_t size() const { return type == Type::Array ? elements.size() : members.size(); }
+
+    const std::vector<JsonValue>& items() const { return elements; }
+    const std::vector<std::pair<std::string, JsonValue>>& fields() const { return members; }
+
+    // Builders
+    JsonValue& set(const std::string& key, JsonValue value);
+    JsonValue& push(JsonValue value);
+
+    bool operator==(const JsonValue& other) const;
+    bool operator!=(const JsonValue& other) const { return !(*this == other); }
+
+private:
+    Type type;
+    bool boolean = false;
+    double number = 0.0;
+    std::string text;
+    std::vector<JsonValue> elements;
+    std::vector<std::pair<std::string, JsonValue>> members;
+
+    void serializeTo(std::string& out) const;
+};
+
+// Escape a string for inclusion between JSON double quotes
+std::string jsonEscape(const std::string& str);
+
+#endif // JSON_HPP
@@ -10,7 +10,8 @@
 // Lexical Analyzer - converts source code into tokens
 class Lexer {
 public:
-    Lexer(const std::string& source);
+    // firstLine lets a fragment of a larger file report its original line numbers
+    Lexer(const std::string& source, int firstLine = 1);
 
     Token getNextToken();    // Get next token and advance
     Token peekToken();       // Look at next token without advancing
@@ -19,7 +20,7 @@ private:
     std::string source;                         // Source code to analyze
     size_t position;                           // Current reading position
     int currentLine;                           // Current line number
-    std::unordered_map<std::string, TokenType> keywords;  // Keyword lookup table
+    const std::unordered_map<std::string, TokenType>& keywords;  // Shared keyword lookup table
 
     char peek();                // Look at next character without consuming
     char advance();             // Consume and return next character
@@ -27,8 +28,12 @@ private:
 
     Token identifier();         // Process identifier or keyword
     Token number();             // Process integer or float literal
+    Token string();             // Process a double-quoted string literal
     void skipWhitespace();      // Skip spaces, tabs, newlines
     void skipComment();         // Skip single-line comments
+
+    // Keyword table shared by all lexers; built once, read-only afterwards
+    static const std::unordered_map<std::string, TokenType>& keywordTable();
 };
 
 #endif
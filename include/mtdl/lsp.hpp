@@ -0,0 +1,17 @@
+#ifndef LSP_HPP
+#define LSP_HPP
+
+// Language server for .mtdl files speaking LSP (JSON-RPC with Content-Length
+// framing) over stdin/stdout:
+//
+//   mtdl --lsp
+//
+// Provides diagnostics on open/change (every failing declaration is reported, not
+// just the first), hover with computed values (tower dps, spawn and wave duration)
+// and go-to-definition for enemy and tower references in spawn and place.
+//
+// Documents are kept split into top-level declarations; an edit re-lexes and
+// re-parses only declarations whose text changed.
+int runLanguageServer();
+
+#endif // LSP_HPP
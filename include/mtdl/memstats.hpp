@@ -0,0 +1,61 @@
+#ifndef MEMSTATS_HPP
+#define MEMSTATS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Heap accounting for -mem-stats. The global operator new/delete, aligned forms
+// included, are replaced (see memstats.cpp) and, once enabled, every allocation
+// and free is counted in a per-thread slot, so threads never contend on a shared
+// counter. While disabled the hooks add one relaxed atomic load to malloc/free.
+class MemStats {
+public:
+    // Totals since enable(), summed over all threads
+    struct Counters {
+        uint64_t allocations = 0;
+        uint64_t bytes = 0;       // Requested bytes
+        int64_t liveBytes = 0;    // Usable bytes allocated minus usable bytes freed
+    };
+
+    static bool enabled() { return active.load(std::memory_order_relaxed); }
+
+    static void enable();
+    static Counters snapshot();
+
+    // High-water mark of the process's resident set size, in KiB
+    static long peakRssKiB();
+
+private:
+    static std::atomic<bool> active;
+};
+
+// Heap usage of one compiler phase
+struct MemPhaseStats {
+    std::string phase;
+    uint64_t allocations;  // Allocations made during the phase
+    uint64_t bytes;        // Bytes requested during the phase
+    int64_t liveBytes;     // Heap still in use when the phase ended
+    long peakRssKiB;       // Peak RSS of the process so far
+};
+
+// Collects MemPhaseStats at phase boundaries. Each endPhase() call attributes
+// everything since the previous boundary to the named phase.
+class MemPhaseReport {
+public:
+    MemPhaseReport();
+
+    void endPhase(const std::string& phase);
+
+    const std::vector<MemPhaseStats>& phases() const { return entries; }
+
+    std::string toText() const;
+    std::string toJSON(const std::string& input) const;
+
+private:
+    MemStats::Counters last;
+    std::vector<MemPhaseStats> entries;
+};
+
+#endif // MEMSTATS_HPP
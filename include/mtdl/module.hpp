@@ -0,0 +1,73 @@
+#ifndef MODULE_HPP
+#define MODULE_HPP
+
+#include "constants.hpp"
+#include "ir.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Appended to a module's path to name its interface file: catalog.mtdl -> catalog.mtdli
+constexpr const char* MODULE_INTERFACE_SUFFIX = "i";
+
+// What a module exports to the sources importing it, already validated
+struct ModuleInterface {
+    std::string path;                                              // Resolved module path
+    uint64_t sourceHash = 0;                                       // See ModuleLoader::sourceHash
+    std::vector<IrInstruction> definitions;                        // Unoptimized; enemies, then towers
+    std::vector<std::pair<std::string, ConstantValue>> constants;  // Const bindings, by name
+};
+
+// What a loader did so far
+struct ModuleStats {
+    size_t imports = 0;  // Modules loaded
+    size_t reused = 0;   // Of those, read from a current interface file instead of compiled
+};
+
+// Resolves import statements to module interfaces.
+//
+// A module may only declare enemies, towers and constants. Loading it the first
+// time compiles it (parsing, semantic analysis, IR generation) and writes a binary
+// interface file next to it: the lowered definitions as an MTDL binary
+// configuration plus the constant values, stamped with a hash of the module source
+// and the compiler version. Every later import, by any level and any process,
+// decodes that file instead for as long as the hash matches. The file is written
+// under a temporary name and renamed into place, so concurrent compiles can share
+// it; when it cannot be written the module is just compiled again next time.
+class ModuleLoader {
+public:
+    // Relative import paths are resolved against directory (empty: working directory)
+    explicit ModuleLoader(const std::string& directory = "");
+
+    // Directory to resolve the imports of a source file against
+    static std::string directoryOf(const std::string& file);
+
+    // Interface of the module at path. Throws std::runtime_error if the module cannot
+    // be read or does not compile; the message names the phase that failed.
+    std::shared_ptr<const ModuleInterface> load(const std::string& path);
+
+    // Hash over the sources of every module that source imports, so that cache keys
+    // change with them; empty when source has no imports
+    std::string importDigest(const std::string& source) const;
+
+    const ModuleStats& stats() const { return counters; }
+
+    // Interface stamp for module source text
+    static uint64_t sourceHash(const std::string& source);
+
+    // Interface file image; decoding returns false for anything malformed
+    static std::string encodeInterface(const ModuleInterface& module);
+    static bool decodeInterface(const std::string& bytes, ModuleInterface& module);
+
+private:
+    std::string directory;
+    ModuleStats counters;
+
+    std::string resolve(const std::string& path) const;
+    ModuleInterface compile(const std::string& source) const;
+};
+
+#endif // MODULE_HPP
@@ -5,6 +5,15 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <string>
+
+// What the optimizer changed; kept whether or not remarks are printed
+struct OptimizerStats {
+    size_t duplicateDefinitions = 0;  // Definitions dropped as repeats
+    size_t mergedSpawns = 0;          // Spawns folded into an identical earlier one
+    size_t deadEnemies = 0;           // Unreferenced enemy definitions removed
+    size_t deadTowers = 0;            // Unreferenced tower definitions removed
+};
 
 // Performs optimization passes on IR code
 class Optimizer {
@@ -12,15 +21,47 @@ public:
     // Main optimization entry point
     std::vector<IrInstruction> optimize(const std::vector<IrInstruction>& instructions);
 
+    // Names of the passes optimize() runs, in order; identifies the pipeline in cache keys
+    static std::string pipelineDescription();
+
+    // Also report each change as a Diagnostics remark (off by default)
+    void setVerbose(bool enabled) { verbose = enabled; }
+
+    // Changes made so far by this optimizer
+    const OptimizerStats& stats() const { return counters; }
+
+    // Precompute derived values (tower dps, spawn total_duration); also used on its
+    // own by tooling that needs those values without the other passes
+    std::vector<IrInstruction> constantFolding(const std::vector<IrInstruction>& instructions);
+
+    // Streaming form of optimize() for IR that arrives one declaration at a time (a
+    // wave together with its spawns). Returns the instructions that are final.
+    // Enemy and tower definitions are held back until finishStream(), because a
+    // reference that keeps them alive through dead code elimination may come later.
+    std::vector<IrInstruction> optimizeDeclaration(const std::vector<IrInstruction>& declaration);
+    std::vector<IrInstruction> finishStream();
+
 private:
+    bool verbose = false;
+    OptimizerStats counters;
+
+    // Streaming state: definitions seen, references seen, definitions held back
+    std::set<std::string> streamDefinitions;
+    std::set<std::string> streamEnemyReferences;
+    std::set<std::string> streamTowerReferences;
+    std::vector<IrInstruction> deferredDefinitions;
+
     // Individual optimization passes
-    std::vector<IrInstruction> constantFolding(const std::vector<IrInstruction>& instructions);
     std::vector<IrInstruction> deadCodeElimination(const std::vector<IrInstruction>& instructions);
     std::vector<IrInstruction> duplicateDefinitionRemoval(const std::vector<IrInstruction>& instructions);
     std::vector<IrInstruction> redundantSpawnMerging(const std::vector<IrInstruction>& instructions);
 
+    // redundantSpawnMerging for IR with REPEAT_SPAWN series, without expanding them
+    std::vector<IrInstruction> mergeSpawnSeries(const std::vector<IrInstruction>& instructions);
+
     // Helper functions
     bool isDefinitionInstruction(IrOpcode opcode);
+    bool isSpawnInstruction(IrOpcode opcode);
     std::string getDefinitionKey(const IrInstruction& instruction);
 };
 
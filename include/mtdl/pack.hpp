@@ -0,0 +1,136 @@
+#ifndef PACK_HPP
+#define PACK_HPP
+
+// Header-only reader for MTDL level packs (mtdl pack create).
+//
+// A pack holds many compiled levels in one file: a fixed header, an index of
+// fixed-size entries sorted by level name, a blob of level names, then each
+// level's artifact (JSON or binary configuration) at an 8-byte aligned offset.
+// A client maps the file, looks a level up by binary search over the index and
+// reads only that level's bytes; binary levels can be handed straight to
+// BinaryConfigView (binary.hpp) without copying.
+//
+// Like binary.hpp, this header depends only on the standard library.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+constexpr char PACK_MAGIC[4] = {'M', 'T', 'P', 'K'};
+constexpr uint16_t PACK_VERSION = 1;
+constexpr uint32_t PACK_ENDIAN_TAG = 0x01020304;
+
+// Artifact kind of a level's payload
+enum PackFormat : uint32_t {
+    PACK_FORMAT_JSON,
+    PACK_FORMAT_BIN
+};
+
+struct PackHeader {
+    char magic[4];         // "MTPK"
+    uint16_t version;      // PACK_VERSION
+    uint16_t headerSize;   // sizeof(PackHeader); the index starts here
+    uint32_t endianTag;    // PACK_ENDIAN_TAG as written by the compiler
+    uint32_t levelCount;   // Entries in the index
+    uint64_t fileSize;     // Total size in bytes
+    uint64_t namesOffset;  // Start of the level name blob
+    uint64_t namesSize;
+};
+
+struct PackEntry {
+    uint64_t offset;      // Payload start, from the beginning of the file; 8-byte aligned
+    uint64_t length;      // Payload size in bytes
+    uint64_t hash;        // FNV-1a 64 of the payload (packHash)
+    uint32_t nameOffset;  // Into the name blob; names are not NUL-terminated
+    uint32_t nameLength;
+    uint32_t format;      // PackFormat
+    uint32_t reserved;
+};
+
+static_assert(sizeof(PackHeader) == 40 && sizeof(PackEntry) == 40, "unexpected record padding");
+
+// 64-bit FNV-1a, the checksum stored in PackEntry::hash
+inline uint64_t packHash(const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Read-only view over a pack held in memory. Does not own the buffer.
+class PackView {
+public:
+    PackView(const void* data, size_t size) : base(static_cast<const unsigned char*>(data)), size(size) {}
+
+    // Check the header and that the index, names and every payload lie inside the
+    // buffer. Reads the index only, never the payloads.
+    bool valid() const {
+        if (size < sizeof(PackHeader) || reinterpret_cast<uintptr_t>(base) % 8 != 0) return false;
+        const PackHeader& h = header();
+        if (std::memcmp(h.magic, PACK_MAGIC, 4) != 0 || h.version != PACK_VERSION ||
+            h.headerSize != sizeof(PackHeader) || h.endianTag != PACK_ENDIAN_TAG || h.fileSize > size) {
+            return false;
+        }
+        uint64_t indexEnd = sizeof(PackHeader) + static_cast<uint64_t>(h.levelCount) * sizeof(PackEntry);
+        if (indexEnd > h.fileSize || h.namesOffset < indexEnd || h.namesOffset > h.fileSize ||
+            h.namesSize > h.fileSize - h.namesOffset) {
+            return false;
+        }
+        for (uint32_t i = 0; i < h.levelCount; i++) {
+            const PackEntry& e = entry(i);
+            if (e.offset % 8 != 0 || e.offset > h.fileSize || e.length > h.fileSize - e.offset ||
+                static_cast<uint64_t>(e.nameOffset) + e.nameLength > h.namesSize) {
+                return false;
+            }
+            if (i > 0 && !(name(entry(i - 1)) < name(e))) return false;  // Sorted, no duplicates
+        }
+        return true;
+    }
+
+    const PackHeader& header() const { return *reinterpret_cast<const PackHeader*>(base); }
+
+    uint32_t levelCount() const { return header().levelCount; }
+    const PackEntry& entry(uint32_t i) const {
+        return reinterpret_cast<const PackEntry*>(base + sizeof(PackHeader))[i];
+    }
+
+    std::string_view name(const PackEntry& e) const {
+        return std::string_view(reinterpret_cast<const char*>(base + header().namesOffset + e.nameOffset),
+                                e.nameLength);
+    }
+
+    // Binary search over the index; nullptr if the pack has no such level
+    const PackEntry* find(std::string_view levelName) const {
+        uint32_t low = 0, high = levelCount();
+        while (low < high) {
+            uint32_t middle = low + (high - low) / 2;
+            std::string_view candidate = name(entry(middle));
+            if (candidate == levelName) return &entry(middle);
+            if (candidate < levelName) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        return nullptr;
+    }
+
+    std::string_view payload(const PackEntry& e) const {
+        return std::string_view(reinterpret_cast<const char*>(base + e.offset), e.length);
+    }
+
+    // Recompute the payload checksum
+    bool verify(const PackEntry& e) const {
+        return packHash(base + e.offset, e.length) == e.hash;
+    }
+
+private:
+    const unsigned char* base;
+    size_t size;
+};
+
+#endif // PACK_HPP
@@ -3,23 +3,36 @@
 
 #include "lexer.hpp"
 #include "ast.hpp"
+#include "constants.hpp"
+#include "module.hpp"
 
 // Syntax Analyzer - builds AST from token stream
 class Parser {
 public:
-    Parser(Lexer& lexer);
+    // constants, if given, supplies and receives the const bindings, so separately
+    // parsed fragments of one source see the constants declared before them.
+    // modules resolves import statements; without it they are left unresolved.
+    Parser(Lexer& lexer, ConstantEvaluator* constants = nullptr, ModuleLoader* modules = nullptr);
 
     // Parse entire program
     std::shared_ptr<Program> parseProgram();
 
+    // Parse the next top-level declaration; returns nullptr at end of input.
+    // Lets a caller consume the program one declaration at a time.
+    std::shared_ptr<AstNode> parseNextDeclaration();
+
 private:
     Lexer& lexer;           // Reference to lexer for token stream
     Token currentToken;     // Current token being processed
+    ConstantEvaluator ownConstants;  // Used when no evaluator is shared
+    ConstantEvaluator* constants;    // Folds expressions, holds const bindings
+    ModuleLoader* modules;           // Loads imported modules (may be null)
 
     // Helper methods
     void advance();                                  // Move to next token
     bool match(TokenType type);                      // Check and consume token if matches
     Token expect(TokenType type, const std::string& errorMessage);  // Require specific token
+    void expectAttribute(const std::string& name);   // Require "name =" for a non-keyword name
 
     // Parse individual declaration types
     std::shared_ptr<AstNode> parseDeclaration();
@@ -27,7 +40,19 @@ private:
     std::shared_ptr<EnemyDecl> parseEnemyDecl();
     std::shared_ptr<TowerDecl> parseTowerDecl();
     std::shared_ptr<WaveDecl> parseWaveDecl();
+    void parseSpawnArguments(SpawnStmt& spawn);  // Enemy, count, start and interval
     std::shared_ptr<PlaceStmt> parsePlaceStmt();
+    std::shared_ptr<ConstDecl> parseConstDecl();
+    std::shared_ptr<ImportDecl> parseImportDecl();
+
+    // Expressions, folded as soon as they are read; what names the expected value
+    // in "expected ..." errors, first is an already-consumed leading operand
+    ConstantValue parseValue(const std::string& what);
+    std::shared_ptr<Expr> parseExpression(const std::string& what, std::shared_ptr<Expr> first = nullptr);
+    std::shared_ptr<Expr> parseTerm(const std::string& what, std::shared_ptr<Expr> first = nullptr);
+    std::shared_ptr<Expr> parseUnary(const std::string& what);
+    int parseInt(const std::string& what);       // Must fold to an integer
+    double parseFloat(const std::string& what);  // Integers are widened
 };
 
 #endif
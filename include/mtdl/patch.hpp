@@ -0,0 +1,38 @@
+#ifndef PATCH_HPP
+#define PATCH_HPP
+
+#include "json.hpp"
+#include <cstddef>
+
+// What a patch does, counted per entity
+struct PatchSummary {
+    size_t added = 0;
+    size_t removed = 0;
+    size_t changed = 0;
+    size_t moved = 0;
+    size_t unchanged = 0;
+};
+
+// Computes the delta between two JSON game configurations (--diff-against) as an
+// RFC 6902 JSON Patch: applying the operations in order to the previous document
+// yields the current one. Entities are matched by name (placements by content)
+// and compared by their "fingerprint" member, so unchanged entities cost one
+// string comparison and never appear in the patch.
+class PatchGenerator {
+public:
+    // Throws std::runtime_error if either document is not a game configuration
+    JsonValue diff(const JsonValue& previous, const JsonValue& current);
+
+    const PatchSummary& summary() const { return counts; }
+
+private:
+    PatchSummary counts;
+    JsonValue operations;
+
+    void diffMap(const JsonValue& previous, const JsonValue& current);
+    void diffSection(const std::string& section, const JsonValue& previous, const JsonValue& current);
+    void addOperation(const char* op, const std::string& path, const JsonValue* value = nullptr,
+                      const std::string& from = std::string());
+};
+
+#endif // PATCH_HPP
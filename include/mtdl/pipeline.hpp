@@ -0,0 +1,35 @@
+#ifndef PIPELINE_HPP
+#define PIPELINE_HPP
+
+#include "optimizer.hpp"
+#include <cstddef>
+#include <string>
+
+// Entries per queue between pipeline stages
+constexpr size_t PIPELINE_QUEUE_DEPTH = 256;
+
+// Outcome of a pipelined compile
+struct PipelineResult {
+    bool success = false;
+    std::string error;        // Phase-prefixed diagnostic, as printed by the compiler
+    size_t declarations = 0;  // Top-level declarations compiled
+    size_t instructions = 0;  // IR instructions written after optimization
+    OptimizerStats optimizer; // Changes made by the optimizer stage
+};
+
+// Streaming compile to JSON (-pipeline). Three stages run on their own threads,
+// connected by bounded SPSC queues:
+//
+//   parse  ->  semantic analysis + IR generation  ->  optimization + JSON output
+//
+// Declarations are dropped as soon as they have been lowered, so neither the
+// whole AST nor the whole IR is ever resident; only enemy and tower definitions
+// wait for the end of input, where dead code elimination decides which survive.
+// The output is byte-identical to the sequential compiler's, and so are the
+// diagnostics: a parse error anywhere takes precedence over a semantic error.
+// Imports are resolved against importDirectory by the parse stage.
+PipelineResult compilePipelined(const std::string& source, const std::string& outputPath, bool optimize,
+                                const std::string& importDirectory = "",
+                                size_t queueDepth = PIPELINE_QUEUE_DEPTH);
+
+#endif // PIPELINE_HPP
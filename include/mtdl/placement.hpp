@@ -0,0 +1,81 @@
+#ifndef PLACEMENT_HPP
+#define PLACEMENT_HPP
+
+#include "geometry.hpp"
+#include "ir.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Independent local-search chains per search; the thread count only changes how
+// fast they finish, never the result
+constexpr size_t PLACEMENT_CHAINS = 8;
+
+// One suggested tower
+struct SuggestedPlacement {
+    std::string tower;
+    int x = 0;
+    int y = 0;
+    int cost = 0;
+    double coverage = 0.0;  // dps times the path length within range
+};
+
+struct PlacementPlan {
+    std::string map;
+    long long budget = 0;
+    long long spent = 0;
+    double coverage = 0.0;      // Sum over the placements
+    double greedy = 0.0;        // Coverage of the greedy start
+    double upperBound = 0.0;    // No placement set within budget covers more
+    size_t freeTiles = 0;
+    size_t candidates = 0;      // (tile, tower) pairs the search considered
+    std::vector<SuggestedPlacement> placements;  // By x, then y
+};
+
+// Budget-constrained tower placement search (mtdl --suggest-placements).
+//
+// A tower placed on a tile is worth its coverage: dps times the length of the
+// first map's path within its range, i.e. the damage it deals to an enemy walking
+// past at speed 1. Towers go on free tiles: inside the map, off the path and not
+// taken by one of the level's own placements, at most one per tile. The search
+// maximizes total coverage within the budget: coverage is precomputed per tile
+// and distinct range on a thread pool, each tower type keeps only the tiles that
+// can appear in an optimal plan (its best budget / cheapest cost ones), a greedy
+// pass by coverage per gold builds the start, and PLACEMENT_CHAINS seeded
+// local-search chains refine it in parallel. The best chain wins, the lowest one
+// on a tie, so a seed always gives the same plan.
+class PlacementSearch {
+public:
+    // ir keeps unplaced towers (unoptimized IR); throws std::runtime_error if it has no map path or towers
+    explicit PlacementSearch(const std::vector<IrInstruction>& ir);
+
+    PlacementPlan search(long long budget, uint64_t seed, size_t threadCount = 0) const;
+
+private:
+    struct TowerType {
+        std::string name;
+        int range;
+        int cost;
+        double dps;
+        size_t rangeIndex;  // Into coverage
+    };
+
+    std::string mapName;
+    int width = 0;
+    int height = 0;
+    MapPath path;
+    std::vector<TowerType> towerTypes;  // Declaration order
+    std::vector<int> ranges;            // Distinct ranges
+    std::vector<char> freeTile;         // Per tile, row-major
+
+    void loadLevel(const std::vector<IrInstruction>& ir);
+    std::vector<std::vector<double>> coverageByRange(size_t threadCount) const;
+};
+
+// mtdl --suggest-placements <file> --budget <gold> [-seed n] [-j n] [-v];
+// argv[1] is "--suggest-placements". Prints place statements and returns the
+// process exit code.
+int runSuggestPlacements(int argc, char* argv[]);
+
+#endif // PLACEMENT_HPP
@@ -0,0 +1,34 @@
+#ifndef QUERY_HPP
+#define QUERY_HPP
+
+#include <cstddef>
+#include <string>
+
+// Outcome of a single-value query
+struct QueryResult {
+    bool success = false;
+    std::string value;          // Compact JSON of the selected value (empty on failure)
+    std::string error;          // Phase-prefixed diagnostic (empty on success)
+    size_t parsed = 0;          // Declarations lexed and parsed to answer the query
+    size_t declarations = 0;    // Declarations in the source
+};
+
+// Demand-driven lookup of one value of the compiled configuration, e.g.
+// "tower.Archer.dps", "wave.Wave1.total_duration" or "map.Castle.path.0.x". The
+// first segment is map, enemy, tower or wave, the second the entity's name; any
+// further segments select members (or array indices) of the entity's JSON object.
+// Waves also answer total_duration, the time the last spawn of the wave ends.
+//
+// Only the entity's own declarations (and, for a wave, the enemies it spawns) are
+// lexed, parsed and checked; the rest of the source is skimmed by the declaration
+// boundary pre-scan. Errors in unrelated declarations are therefore not reported.
+// Imports are always resolved (against importDirectory), since they bind constants
+// and may define the entity or its enemies. Reentrant, like compileSource.
+QueryResult evaluateQuery(const std::string& source, const std::string& path,
+                          const std::string& importDirectory = "");
+
+// mtdl --query <file> <path> [-v]; argv[1] is "--query". Prints the value and
+// returns the process exit code.
+int runQuery(int argc, char* argv[]);
+
+#endif // QUERY_HPP
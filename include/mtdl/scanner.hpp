@@ -0,0 +1,38 @@
+#ifndef SCANNER_HPP
+#define SCANNER_HPP
+
+#include "token.hpp"
+#include <string>
+#include <vector>
+
+// Source range of one top-level declaration, found without tokenizing its body
+struct DeclarationSpan {
+    TokenType kind;    // MAP, ENEMY, TOWER, WAVE, PLACE, CONST, IMPORT, or UNKNOWN for stray text
+    std::string name;  // Declared name (tower type for place statements, module path for imports)
+    size_t begin;      // Offset of the leading keyword
+    size_t nameOffset; // Offset of name
+    size_t end;        // One past the closing '}' or ';'
+    int line;          // Line of the leading keyword
+    int endLine;       // Line of the last character of the span
+};
+
+// Cheap declaration-boundary pre-scan: skips whitespace and comments, then matches
+// braces (or the terminating ';' of a place, const or import statement) for each
+// declaration. Returns false if the top level contains anything other than
+// declarations. Stray text is reported as an UNKNOWN span reaching up to the next
+// declaration keyword, and scanning continues after it.
+bool scanDeclarations(const std::string& source, std::vector<DeclarationSpan>& spans);
+
+// Scanner state between two declarations
+struct ScanPosition {
+    size_t offset;
+    int line;
+};
+
+// Resumable form for editors: scan from a known boundary and stop before any
+// declaration that would start at or after limit. Returns where scanning stopped,
+// which is that declaration's keyword or the end of the source.
+ScanPosition scanDeclarations(const std::string& source, ScanPosition from, size_t limit,
+                              std::vector<DeclarationSpan>& spans);
+
+#endif // SCANNER_HPP
@@ -2,6 +2,7 @@
 #define SEMANTIC_HPP
 
 #include "ast.hpp"
+#include <set>
 #include <unordered_map>
 #include <string>
 
@@ -10,13 +11,22 @@ class SemanticAnalyzer {
 public:
     void analyze(std::shared_ptr<Program> program);
 
+    // Check one top-level declaration against everything analyzed before it.
+    // Throws std::runtime_error on the first problem; the analyzer stays usable, so
+    // tooling can keep checking later declarations to report several errors.
+    // Earlier declarations are afterwards only looked up by name, except the most
+    // recent map, which must stay alive while placements are checked against it.
+    void analyzeDeclaration(AstNode* declaration);
+
 private:
-    // Symbol tables for each declaration type
+    // Symbol tables for each declaration type; imported enemies and towers have no node
     std::unordered_map<std::string, MapDecl*> mapDeclarations;
     std::unordered_map<std::string, EnemyDecl*> enemyDeclarations;
     std::unordered_map<std::string, TowerDecl*> towerDeclarations;
     std::unordered_map<std::string, WaveDecl*> waveDeclarations;
 
+    std::set<std::string> importedModules;  // Resolved paths
+
     MapDecl* currentMap = nullptr;  // Track current map for placement validation
 
     // Validation methods for each AST node type
@@ -24,7 +34,9 @@ private:
     void checkEnemy(EnemyDecl* enemy);
     void checkTower(TowerDecl* tower);
     void checkWave(WaveDecl* wave);
+    void checkRepeat(const SpawnStmt& spawn);
     void checkPlacement(PlaceStmt* placement);
+    void checkImport(ImportDecl* importDecl);
 };
 
 #endif
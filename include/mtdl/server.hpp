@@ -0,0 +1,21 @@
+#ifndef SERVER_HPP
+#define SERVER_HPP
+
+// Persistent compile server over a Unix domain socket, plus its client.
+//
+//   mtdl --serve <socket>                       Run the daemon until SHUTDOWN
+//   mtdl --client <socket> <file> [options]     Compile one file through the daemon
+//   mtdl --client <socket> --shutdown           Stop the daemon
+//   mtdl --client-bench <socket> <file>... [-n requests]
+//                                               Report round-trip p50/p99 per file
+//
+// Messages are framed as a 32-bit length followed by the payload. A request is
+// "COMPILE <format> <optimize 0|1> <normalized 0|1> [<import directory>]\n<source>",
+// "STATS\n" or "SHUTDOWN\n"; a response is "OK\n<artifact>" or "ERROR\n<diagnostic>".
+//
+// argv[1] is the mode flag for each entry point; each returns the exit code.
+int runServer(int argc, char* argv[]);
+int runClient(int argc, char* argv[]);
+int runClientBench(int argc, char* argv[]);
+
+#endif // SERVER_HPP
@@ -0,0 +1,108 @@
+#ifndef SIMULATOR_HPP
+#define SIMULATOR_HPP
+
+#include "ir.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Default simulation step in seconds (-dt)
+constexpr double SIMULATION_TIMESTEP = 0.05;
+
+// What happened to one wave
+struct WaveOutcome {
+    std::string name;
+    size_t spawned = 0;
+    size_t kills = 0;
+    size_t leaks = 0;        // Enemies that reached the end of the path
+    long long gold = 0;      // Rewards of the kills
+    double clearTime = 0.0;  // Seconds from the wave start until no enemy is left
+};
+
+// Result of a whole simulation; every field is reproducible bit for bit
+struct SimulationReport {
+    std::string map;
+    double timestep = SIMULATION_TIMESTEP;
+    std::vector<WaveOutcome> waves;
+    uint64_t steps = 0;            // Timesteps over all waves
+    double simulatedSeconds = 0.0;
+};
+
+// Fixed-timestep headless simulation of a compiled level (mtdl --simulate).
+//
+// Each wave is played on its own from time 0 against the level's placements:
+// enemies walk the first map's path at their speed, and every tower shoots the
+// enemy in range that is furthest along the path (the earlier spawned one on a
+// tie) at its fire rate, for its damage. One step spawns what is due, moves every
+// enemy, retires those past the end of the path as leaks, lets the towers fire in
+// placement order and then retires the dead. Towers find candidates through a
+// uniform grid over the map, rebuilt each step with a counting sort; enemy state
+// lives in parallel arrays kept in spawn order. The simulation is single-threaded
+// and uses no unordered containers, so results are identical across runs.
+class WaveSimulator {
+public:
+    // ir is optimized IR; throws std::runtime_error if it has no map or path
+    explicit WaveSimulator(const std::vector<IrInstruction>& ir, double timestep = SIMULATION_TIMESTEP);
+
+    SimulationReport run();
+
+private:
+    struct EnemyType {
+        int hp;
+        double speed;
+        int reward;
+    };
+
+    struct Spawn {
+        long long time;  // Seconds from the wave start
+        uint32_t type;
+    };
+
+    struct Wave {
+        std::string name;
+        std::vector<Spawn> spawns;  // By time, then source order
+    };
+
+    double timestep;
+    std::string mapName;
+    int width = 0;
+    int height = 0;
+
+    // Path segments: start point, unit direction and arc length at the start
+    std::vector<double> pathX, pathY, directionX, directionY, pathOffset;
+    double pathLength = 0.0;
+
+    std::vector<EnemyType> enemyTypes;
+    std::vector<Wave> waves;
+
+    // Placed towers
+    std::vector<double> towerX, towerY, towerRangeSquared, towerPeriod;
+    std::vector<int> towerDamage;
+    std::vector<int> towerCellMinX, towerCellMaxX, towerCellMinY, towerCellMaxY;
+
+    // Live enemies, in spawn order
+    std::vector<uint32_t> enemyType, enemySegment;
+    std::vector<double> enemyProgress, enemyX, enemyY, enemySpeed;
+    std::vector<int> enemyHp;
+
+    // Uniform grid: enemies of cell c are gridEnemies[gridStart[c] .. gridStart[c + 1])
+    double cellSize = 1.0;
+    int gridColumns = 1;
+    int gridRows = 1;
+    std::vector<uint32_t> gridStart, gridEnemies, enemyCell, gridCursor;
+
+    void loadLevel(const std::vector<IrInstruction>& ir);
+    WaveOutcome simulateWave(const Wave& wave, uint64_t& steps);
+    void spawnEnemy(uint32_t type);
+    void moveEnemies(double seconds);
+    void buildGrid();
+    int cellOf(double x, double y) const;
+    void retire(WaveOutcome& outcome);
+};
+
+// mtdl --simulate <file> [-dt seconds] [-json] [-v]; argv[1] is "--simulate".
+// Prints the report and returns the process exit code.
+int runSimulate(int argc, char* argv[]);
+
+#endif // SIMULATOR_HPP
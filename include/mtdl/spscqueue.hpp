@@ -0,0 +1,101 @@
+#ifndef SPSCQUEUE_HPP
+#define SPSCQUEUE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Bounded single-producer/single-consumer ring buffer connecting two pipeline
+// stages. push() and pop() are lock-free while the queue is neither full nor
+// empty; a blocked side spins briefly, then sleeps until the other side moves.
+template <typename T>
+class SpscQueue {
+public:
+    // Capacity is rounded up to a power of two
+    explicit SpscQueue(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) size <<= 1;
+        slots.resize(size);
+        mask = size - 1;
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Producer: blocks while full. Returns false if the queue was closed, in which
+    // case the item is dropped.
+    bool push(T item) {
+        size_t tail = tailIndex.load(std::memory_order_relaxed);
+        for (unsigned spins = 0; tail - headIndex.load(std::memory_order_acquire) == slots.size(); spins++) {
+            if (closed.load(std::memory_order_acquire)) return false;
+            backoff(spins);
+        }
+        if (closed.load(std::memory_order_acquire)) return false;
+        slots[tail & mask] = std::move(item);
+        tailIndex.store(tail + 1, std::memory_order_release);
+        wake();
+        return true;
+    }
+
+    // Consumer: blocks while empty. Returns false once the queue is closed and drained.
+    bool pop(T& item) {
+        size_t head = headIndex.load(std::memory_order_relaxed);
+        for (unsigned spins = 0; tailIndex.load(std::memory_order_acquire) == head; spins++) {
+            if (closed.load(std::memory_order_acquire) &&
+                tailIndex.load(std::memory_order_acquire) == head) {
+                return false;
+            }
+            backoff(spins);
+        }
+        item = std::move(slots[head & mask]);
+        slots[head & mask] = T();
+        headIndex.store(head + 1, std::memory_order_release);
+        wake();
+        return true;
+    }
+
+    // End of stream when called by the producer; tells the producer to stop when
+    // called by the consumer
+    void close() {
+        closed.store(true, std::memory_order_release);
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        moved.notify_all();
+    }
+
+private:
+    std::vector<T> slots;
+    size_t mask;
+    alignas(64) std::atomic<size_t> headIndex{0};  // Next slot to pop
+    alignas(64) std::atomic<size_t> tailIndex{0};  // Next slot to push
+    std::atomic<bool> closed{false};
+
+    std::mutex sleepMutex;
+    std::condition_variable moved;
+    std::atomic<int> sleepers{0};
+
+    void backoff(unsigned spins) {
+        if (spins < 64) {
+            std::this_thread::yield();
+            return;
+        }
+        // A wake-up can slip between the check and the wait; the timeout bounds it
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepers.fetch_add(1, std::memory_order_seq_cst);
+        moved.wait_for(lock, std::chrono::milliseconds(1));
+        sleepers.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void wake() {
+        if (sleepers.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            moved.notify_all();
+        }
+    }
+};
+
+#endif // SPSCQUEUE_HPP
@@ -0,0 +1,51 @@
+#ifndef SWEEP_HPP
+#define SWEEP_HPP
+
+#include "ir.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+// One change to an enemy or tower attribute, e.g. "tower.Archer.damage=*1.1"
+struct SweepOverride {
+    IrOpcode definition = IrOpcode::DEFINE_TOWER;  // DEFINE_ENEMY or DEFINE_TOWER
+    std::string name;                              // Entity name, or "*" for all of them
+    std::string attribute;                         // Metadata key (hp, speed, damage, ...)
+    char operation = '=';                          // '=' set, '*' scale, '+' add
+    double operand = 0.0;
+};
+
+// A named set of overrides applied together to the base level
+struct SweepVariant {
+    std::string name;
+    std::vector<SweepOverride> overrides;
+};
+
+// Parse a sweep specification: one variant per line, '#' starts a comment.
+//
+//   <name> <kind>.<entity>.<attribute>=<value>[,<value>...] ...
+//
+// kind is enemy (hp, speed, reward) or tower (range, damage, fire_rate, cost),
+// entity a name or *. A value is a number to set, *factor to scale or +delta
+// (-delta) to add. A line with value lists stands for every combination of them,
+// named <name>-0, <name>-1, ... with the first list varying slowest. Returns false
+// with a line-numbered message in error.
+bool parseSweepSpec(const std::string& text, std::vector<SweepVariant>& variants, std::string& error);
+
+// Conversions between plain and shared IR
+SharedIr shareIr(std::vector<IrInstruction> ir);
+std::vector<IrInstruction> materializeIr(const SharedIr& ir);
+
+// Apply variant to base: only the definitions it changes are copied, rounded to
+// the attribute's type, validated like semantic analysis would, and (when fold is
+// set) re-folded, which for these attributes means recomputing tower dps. Spawns,
+// placements and everything else stay shared. Returns false with a message in error.
+bool deriveVariant(const SharedIr& base, const SweepVariant& variant, bool fold, SharedIr& ir,
+                   std::string& error, size_t* copied = nullptr);
+
+// mtdl --sweep <spec> <file> --out-dir <dir> [-format f] [-normalized] [-no-opt] [-j n] [-v]
+// Compiles the base level once and writes one artifact per variant, rendered in
+// parallel. argv[1] is "--sweep". Returns the process exit code.
+int runSweep(int argc, char* argv[]);
+
+#endif // SWEEP_HPP
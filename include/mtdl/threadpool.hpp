@@ -0,0 +1,54 @@
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing thread pool. Every worker owns a deque: it pops its own work
+// from the back and, when idle, steals from the front of the other workers'
+// deques. Tasks must handle their own exceptions.
+class ThreadPool {
+public:
+    // threadCount of 0 uses one worker per hardware thread
+    explicit ThreadPool(size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Queue a task; tasks submitted from a worker go to that worker's own deque
+    void submit(std::function<void()> task);
+
+    // Block until every submitted task has finished
+    void wait();
+
+    size_t size() const { return threads.size(); }
+
+private:
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;  // One per worker
+    std::vector<std::thread> threads;
+
+    std::mutex stateMutex;
+    std::condition_variable workAvailable;
+    std::condition_variable allDone;
+    size_t queued = 0;   // Tasks sitting in some deque
+    size_t pending = 0;  // Tasks submitted but not yet finished
+    size_t nextQueue = 0;
+    bool stopping = false;
+
+    bool takeTask(size_t self, std::function<void()>& task);
+    void workerLoop(size_t self);
+};
+
+#endif // THREADPOOL_HPP
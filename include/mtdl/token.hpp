@@ -6,16 +6,16 @@
 // All possible token types in the MTDL language
 enum class TokenType {
     // Keywords
-    MAP, ENEMY, TOWER, WAVE, SPAWN, PLACE, AT,
-    SIZE, PATH, COUNT, START, INTERVAL,
+    MAP, ENEMY, TOWER, WAVE, SPAWN, REPEAT, PLACE, AT,
+    SIZE, PATH, COUNT, START, INTERVAL, CONST, IMPORT,
 
     // Identifiers and literals
-    IDENT, INT, FLOAT,
+    IDENT, INT, FLOAT, STRING,
 
     // Punctuation and operators
     LBRACE, RBRACE, LPAREN, RPAREN, LBRACKET, RBRACKET,
     COMMA, SEMICOLON, EQUAL,
-    PLUS, MINUS, MUL, DIV,  // Future arithmetic support
+    PLUS, MINUS, MUL, DIV,  // Compile-time arithmetic
 
     // Special tokens
     END_OF_FILE,
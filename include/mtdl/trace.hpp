@@ -0,0 +1,79 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Span tracing for -trace. Spans are appended to a buffer owned by the recording
+// thread and written out as Chrome trace-event JSON, which chrome://tracing and
+// ui.perfetto.dev show as one track per thread. While tracing is off, a span
+// costs a single relaxed atomic load and never reads the clock.
+class Tracer {
+public:
+    static bool enabled() { return active.load(std::memory_order_relaxed); }
+
+    // Start recording; timestamps are relative to this call
+    static void start();
+
+    // Stop recording and write every buffered span. Threads that recorded spans
+    // must have finished (or be idle) by now.
+    static bool writeChromeTrace(const std::string& path);
+
+    // Label the calling thread's track
+    static void setThreadName(const std::string& name);
+
+    // Nanoseconds since start()
+    static uint64_t now();
+
+    // Append a completed span to the calling thread's buffer. name and category
+    // must be string literals; detail is free-form and shown under the span's args.
+    static void record(const char* name, const char* category, uint64_t begin, uint64_t end,
+                       const std::string& detail = std::string());
+
+private:
+    static std::atomic<bool> active;
+};
+
+// Records the enclosing scope as one span
+class TraceSpan {
+public:
+    explicit TraceSpan(const char* name, const char* category = "compiler")
+        : name(name), category(category), recording(Tracer::enabled()),
+          begin(recording ? Tracer::now() : 0) {}
+
+    TraceSpan(const char* name, const char* category, const std::string& detail)
+        : TraceSpan(name, category) {
+        if (recording) this->detail = detail;
+    }
+
+    ~TraceSpan() {
+        if (recording) Tracer::record(name, category, begin, Tracer::now(), detail);
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const char* name;
+    const char* category;
+    bool recording;
+    uint64_t begin;
+    std::string detail;
+};
+
+// Starts tracing if path is non-empty and writes the trace when it goes out of
+// scope, so every exit path of a command produces a file
+class TraceSession {
+public:
+    explicit TraceSession(const std::string& path);
+    ~TraceSession();
+
+    TraceSession(const TraceSession&) = delete;
+    TraceSession& operator=(const TraceSession&) = delete;
+
+private:
+    std::string path;
+};
+
+#endif // TRACE_HPP
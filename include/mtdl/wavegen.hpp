@@ -0,0 +1,100 @@
+#ifndef WAVEGEN_HPP
+#define WAVEGEN_HPP
+
+#include "ir.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Bounds of the generated spawns
+constexpr int WAVEGEN_MAX_GROUPS = 3;  // Spawn statements per wave
+constexpr int WAVEGEN_MAX_COUNT = 100;
+constexpr int WAVEGEN_MAX_INTERVAL = 10;
+
+struct GeneratedSpawn {
+    std::string enemy;
+    int count = 1;
+    int start = 0;
+    int interval = 1;
+};
+
+struct GeneratedWave {
+    std::string name;
+    double target = 0.0;      // Difficulty the curve asks for
+    double difficulty = 0.0;  // What the model rates the spawns
+    int duration = 0;         // Seconds until the last spawn group ends
+    std::vector<GeneratedSpawn> spawns;
+};
+
+// Parse a difficulty curve: target difficulties separated by commas
+// ("0.5,0.8,1.2"), or a linear ramp "<first>..<last>:<waves>". Targets must be
+// positive. Returns false with a message in error.
+bool parseDifficultyCurve(const std::string& text, std::vector<double>& curve, std::string& error);
+
+// Difficulty-targeted wave synthesis (mtdl --gen-waves).
+//
+// The model rates a wave by its peak load on the placed towers. A tower covering
+// L of the path deals its dps to a stream of enemies of speed v spawned every i
+// seconds for min(1, L / (v * i)) of the time, so the towers can take
+// capacity = sum(dps * min(1, L / (v * i))) HP per second out of the stream,
+// which brings in hp / i. A spawn group's load is that demand over capacity; the
+// loads of overlapping groups add up, and the wave's difficulty is the highest
+// total at any time. 1 means the towers just keep up, more means enemies get
+// through. For one enemy at a time it reduces to hp over the damage it takes
+// walking the whole path.
+//
+// Each wave is searched on its own: seeded batches of random spawn sets are
+// scored on a thread pool, then the best is refined by hill climbing over its
+// counts, starts, intervals and enemy types. A candidate's score is its distance
+// from the target difficulty plus a smaller penalty for ending far from the
+// target duration. Batches and their seeds do not depend on the thread count,
+// so a seed always gives the same waves.
+class WaveGenerator {
+public:
+    // ir is unoptimized IR, so enemies no wave spawns yet survive; throws
+    // std::runtime_error without enemies or without placed towers covering the path
+    explicit WaveGenerator(const std::vector<IrInstruction>& ir);
+
+    std::vector<GeneratedWave> generate(const std::vector<double>& curve, const std::string& prefix,
+                                        int targetDuration, uint64_t seed, size_t threadCount = 0) const;
+
+private:
+    struct EnemyType {
+        std::string name;
+        double hp;
+        std::vector<double> loadByInterval;  // Demand over capacity, index interval - 1
+    };
+
+    struct Group {
+        int enemy;
+        int count;
+        int start;
+        int interval;
+    };
+
+    struct Candidate {
+        int groups = 0;
+        Group group[WAVEGEN_MAX_GROUPS];
+    };
+
+    std::vector<EnemyType> enemyTypes;  // Declaration order
+
+    void loadLevel(const std::vector<IrInstruction>& ir);
+    double peakLoad(const Candidate& candidate) const;
+    double score(const Candidate& candidate, double target, int targetDuration) const;
+    Candidate refine(Candidate best, double target, int targetDuration) const;
+};
+
+// Wave declarations in source form, ready to paste into a level
+std::string waveSource(const std::vector<GeneratedWave>& waves);
+
+// ir with its own waves replaced by the generated ones, run through Optimizer
+std::vector<IrInstruction> withGeneratedWaves(const std::vector<IrInstruction>& ir,
+                                              const std::vector<GeneratedWave>& waves);
+
+// mtdl --gen-waves <curve> <file> [-duration s] [-prefix name] [-seed n] [-j n]
+// [-ir | -o file] [-v]; argv[1] is "--gen-waves". Returns the process exit code.
+int runGenWaves(int argc, char* argv[]);
+
+#endif // WAVEGEN_HPP